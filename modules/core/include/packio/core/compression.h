@@ -51,6 +51,22 @@ namespace packio
         }
     }
 
+    // Helper to read a length-prefixed payload without trusting the length for the allocation. The buffer grows
+    // chunk by chunk with the bytes actually present, so a corrupted length fails on EOF instead of allocating it.
+    inline std::vector<char> readChunked(std::istream& stream, size_t size, const char* errorMsg) {
+        static constexpr size_t CHUNK_SIZE = size_t{1} << 20;
+
+        std::vector<char> buffer;
+        buffer.reserve(std::min(size, CHUNK_SIZE));
+        while (buffer.size() < size) {
+            const size_t offset = buffer.size();
+            const size_t chunk = std::min(size - offset, CHUNK_SIZE);
+            buffer.resize(offset + chunk);
+            readAll(stream, buffer.data() + offset, static_cast<std::streamsize>(chunk), errorMsg);
+        }
+        return buffer;
+    }
+
     inline uint64_t fnv1a_64(const void* data, size_t length) {
         static constexpr uint64_t FNV_OFFSET_BASIS = 1469598103934665603ULL;
         static constexpr uint64_t FNV_PRIME        = 1099511628211ULL;
@@ -110,6 +126,19 @@ namespace packio
 
     // Decompress data using Zstd
     inline std::vector<char> decompressZstd(const void* data, size_t compressedSize, size_t expectedDecompressedSize) {
+        // Cross-check the expected size against the frame header before allocating the output buffer
+        unsigned long long frameContentSize = ZSTD_getFrameContentSize(data, compressedSize);
+        if (frameContentSize == ZSTD_CONTENTSIZE_ERROR) {
+            throw std::runtime_error("Zstd decompression failed: invalid frame header");
+        }
+        // compressZstd always records the content size, its absence leaves the expected size unverified
+        if (frameContentSize == ZSTD_CONTENTSIZE_UNKNOWN) {
+            throw std::runtime_error("Zstd decompression failed: frame content size is unknown");
+        }
+        if (frameContentSize != expectedDecompressedSize) {
+            throw std::runtime_error("Decompression size mismatch (possible data corruption).");
+        }
+
         std::vector<char> decompressed(expectedDecompressedSize);
 
         size_t actualSize = ZSTD_decompress(
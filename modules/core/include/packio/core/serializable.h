@@ -35,6 +35,7 @@ SOFTWARE.
 #include <zstd.h>
 #include <zstd_errors.h>
 #include <stdint.h>
+#include <limits>
 
 #ifdef __GNUC__
 #define PACKIO_PACKED(...) __VA_ARGS__ __attribute__((__packed__))
@@ -96,6 +97,17 @@ namespace packio
         uint16_t versionMajor{}, versionMinor{}, versionPatch{};
     };
 
+    /**
+     * @brief Limits enforced on the sizes read from a serialized header, before any buffer is allocated.
+     *
+     * The defaults accept any record; structural checks (stream length, zstd frame header) are always applied.
+     * Tighten them when decoding untrusted input.
+     */
+    struct DecodeLimits {
+        size_t maxRecordSize = std::numeric_limits<size_t>::max();      ///< Maximum serialized body size, in bytes
+        size_t maxCompressionRatio = std::numeric_limits<size_t>::max(); ///< Maximum uncompressed/compressed ratio
+    };
+
     /**
      * @brief Serialize a serializable signature to identify the serializable implementation.
      *
@@ -139,14 +151,127 @@ namespace packio
     // ************************************************************************************************************
     // Available function for serializable instances
     // ************************************************************************************************************
+    /**
+     * Read the record following the signature and version, and return its validated body.
+     *
+     * Handles the compression flag, checks the header sizes against the limits before allocating, verifies the
+     * checksum and decompresses if needed.
+     *
+     * @param stream The input stream positioned on the compression flag.
+     * @param limits Size limits checked against the header before allocating.
+     * @return A binary stream over the validated body, ready for deserializeBody.
+     */
+    inline std::istringstream readRecord(std::istream& stream, const DecodeLimits& limits)
+    {
+        if(stream.bad()){
+            throw std::runtime_error("Attempt to deserialize with a bad stream");
+        }
+
+        // 1) Read compression flag
+        uint8_t compressionFlag;
+        readAll(stream, &compressionFlag, sizeof(compressionFlag),
+                "Failed to read compression flag");
+        if (compressionFlag > 1) {
+            throw std::runtime_error("Invalid compression flag: Data corruption detected");
+        }
+
+        if (compressionFlag == 1) {
+            // ---- COMPRESSION BRANCH ----
+
+            // A) Read sizes + checksum
+            size_t uncompressedSize = 0;
+            readAll(stream, &uncompressedSize, sizeof(uncompressedSize),
+                    "Failed to read uncompressed size");
+            size_t compressedSize = 0;
+            readAll(stream, &compressedSize, sizeof(compressedSize),
+                    "Failed to read compressed size");
+
+            uint64_t checksumStored;
+            readAll(stream, &checksumStored, sizeof(checksumStored),
+                    "Failed to read checksum");
+
+            // B) Validate sizes before allocating anything
+            if (uncompressedSize > limits.maxRecordSize) {
+                throw std::runtime_error("Uncompressed size exceeds the decode limit");
+            }
+            const size_t compressedBound = ZSTD_compressBound(uncompressedSize);
+            if (ZSTD_isError(compressedBound) || compressedSize == 0 || compressedSize > compressedBound) {
+                throw std::runtime_error("Invalid compressed size: Data corruption detected");
+            }
+            // compressedSize * maxCompressionRatio overflowing means the ratio cannot be exceeded
+            const bool ratioOverflows = limits.maxCompressionRatio != 0 &&
+                    compressedSize > std::numeric_limits<size_t>::max() / limits.maxCompressionRatio;
+            if (!ratioOverflows && uncompressedSize > compressedSize * limits.maxCompressionRatio) {
+                throw std::runtime_error("Compression ratio exceeds the decode limit");
+            }
+
+            // C) Read compressed data
+            std::vector<char> compressedData = readChunked(stream, compressedSize,
+                                                           "Failed to read compressed data");
+
+            // D) Verify checksum
+            uint64_t checksumComputed = computeChecksum(compressedData.data(), compressedSize);
+            if (checksumComputed != checksumStored) {
+                throw std::runtime_error("Checksum verification failed: Data corruption detected");
+            }
+
+            // E) Decompress
+            std::vector<char> uncompressedData = decompressZstd(
+                    compressedData.data(), compressedSize, uncompressedSize
+            );
+
+            return std::istringstream(std::string(uncompressedData.begin(), uncompressedData.end()),
+                                      std::ios::binary);
+
+        } else {
+            // ---- NO COMPRESSION ----
+
+            // A) Figure out how much data is left excluding the checksum
+            std::streampos startPos = stream.tellg();
+            stream.seekg(0, std::ios::end);
+            std::streampos endPos = stream.tellg();
+            // We expect the last 8 bytes to be the XXH64 checksum
+            if (endPos < startPos + static_cast<std::streamoff>(sizeof(uint64_t))) {
+                throw std::runtime_error("Stream is too short (no space for checksum)");
+            }
+
+            std::streamsize dataSize = static_cast<std::streamsize>(endPos - startPos - sizeof(uint64_t));
+            if (static_cast<size_t>(dataSize) > limits.maxRecordSize) {
+                throw std::runtime_error("Uncompressed size exceeds the decode limit");
+            }
+
+            // B) Read uncompressed data
+            std::vector<char> serializedData(dataSize);
+            stream.seekg(startPos);
+            readAll(stream, serializedData.data(), dataSize,
+                    "Failed to read uncompressed data");
+
+            // C) Read checksum
+            uint64_t checksumStored;
+            readAll(stream, &checksumStored, sizeof(checksumStored),
+                    "Failed to read checksum");
+
+            // D) Verify checksum
+            uint64_t checksumComputed = computeChecksum(serializedData.data(), dataSize);
+            if (checksumComputed != checksumStored) {
+                throw std::runtime_error("Checksum verification failed: Data corruption detected");
+            }
+
+            return std::istringstream(std::string(serializedData.begin(), serializedData.end()),
+                                      std::ios::binary);
+        }
+    }
+
     // Define helper struct DeserializeHelper outside of Deserializer
     template<typename U, int MAJOR, int MINOR, int PATCH, typename T, typename... Args>
     struct DeserializeHelper {
-        static U deserialize(std::istream& stream, const std::array<char, 16>& signature) {
+        static U deserialize(std::istream& stream, const std::array<char, 16>& signature,
+                             const DecodeLimits& limits = {}) {
             if (std::equal(std::begin(signature), std::end(signature), std::begin(serializeSignature<T>()))) {
-                return deserializeBody<U, T, MAJOR, MINOR, PATCH>(stream);
+                std::istringstream validatedStream = readRecord(stream, limits);
+                return deserializeBody<U, T, MAJOR, MINOR, PATCH>(validatedStream);
             } else {
-                return DeserializeHelper<U, MAJOR, MINOR, PATCH, Args...>::deserialize(stream, signature);
+                return DeserializeHelper<U, MAJOR, MINOR, PATCH, Args...>::deserialize(stream, signature, limits);
             }
         }
     };
@@ -160,101 +285,21 @@ namespace packio
      * @tparam MINOR  Expected minor version.
      * @tparam PATCH  Expected patch version.
      * @tparam T      The original type (usually same as U, but can vary if you have custom expansions).
+     * @param limits  Size limits checked against the header before allocating.
      */
     template<typename U, int MAJOR, int MINOR, int PATCH, typename T>
     struct DeserializeHelper<U, MAJOR, MINOR, PATCH, T> {
-        static U deserialize(std::istream& stream, const std::array<char, 16>& signature)
+        static U deserialize(std::istream& stream, const std::array<char, 16>& signature,
+                             const DecodeLimits& limits = {})
         {
-            if(stream.bad()){
-                throw std::runtime_error("Attempt to deserialize with a bad stream");
-            }
-
-            // 1) Check signature
+            // Check signature
             std::array<char, 16> expectedSig = serializeSignature<T>();
             if (!std::equal(signature.begin(), signature.end(), expectedSig.begin())) {
                 throw std::runtime_error("Attempt to deserialize an unrecognized serializable");
             }
 
-            // 2) Read compression flag
-            bool isCompressed;
-            readAll(stream, &isCompressed, sizeof(isCompressed),
-                    "Failed to read compression flag");
-
-            if (isCompressed) {
-                // ---- COMPRESSION BRANCH ----
-
-                // A) Read sizes + checksum
-                size_t uncompressedSize = 0;
-                readAll(stream, &uncompressedSize, sizeof(uncompressedSize),
-                        "Failed to read uncompressed size");
-                size_t compressedSize = 0;
-                readAll(stream, &compressedSize, sizeof(compressedSize),
-                        "Failed to read compressed size");
-
-                uint64_t checksumStored;
-                readAll(stream, &checksumStored, sizeof(checksumStored),
-                        "Failed to read checksum");
-
-                // B) Read compressed data
-                std::vector<char> compressedData(compressedSize);
-                readAll(stream, compressedData.data(), compressedSize,
-                        "Failed to read compressed data");
-
-                // C) Verify checksum
-                uint64_t checksumComputed = computeChecksum(compressedData.data(), compressedSize);
-                if (checksumComputed != checksumStored) {
-                    throw std::runtime_error("Checksum verification failed: Data corruption detected");
-                }
-
-                // D) Decompress
-                std::vector<char> uncompressedData = decompressZstd(
-                        compressedData.data(), compressedSize, uncompressedSize
-                );
-
-                // E) Deserialize from uncompressed data
-                std::stringstream tempBuffer(std::string(uncompressedData.begin(), uncompressedData.end()),
-                                             std::ios::binary | std::ios::in);
-                return deserializeBody<T>(tempBuffer);
-
-            } else {
-                // ---- NO COMPRESSION ----
-
-                // A) Figure out how much data is left excluding the checksum
-                std::streampos startPos = stream.tellg();
-                stream.seekg(0, std::ios::end);
-                std::streampos endPos = stream.tellg();
-                // We expect the last 8 bytes to be the XXH64 checksum
-                if (endPos < startPos + static_cast<std::streamoff>(sizeof(uint64_t))) {
-                    throw std::runtime_error("Stream is too short (no space for checksum)");
-                }
-
-                std::streamsize dataSize = static_cast<std::streamsize>(endPos - startPos - sizeof(uint64_t));
-
-                // B) Read uncompressed data
-                std::vector<char> serializedData(dataSize);
-                stream.seekg(startPos);
-                readAll(stream, serializedData.data(), dataSize,
-                        "Failed to read uncompressed data");
-
-                // C) Read checksum
-                uint64_t checksumStored;
-                readAll(stream, &checksumStored, sizeof(checksumStored),
-                        "Failed to read checksum");
-
-                // D) Verify checksum
-                uint64_t checksumComputed = computeChecksum(serializedData.data(), dataSize);
-                if (checksumComputed != checksumStored) {
-                    throw std::runtime_error("Checksum verification failed: Data corruption detected");
-                }
-
-                // E) Deserialize from the validated data
-                std::istringstream validatedStream(
-                        std::string(serializedData.begin(), serializedData.end()),
-                        std::ios::binary
-                );
-
-                return deserializeBody<T>(validatedStream);
-            }
+            std::istringstream validatedStream = readRecord(stream, limits);
+            return deserializeBody<T>(validatedStream);
         }
     };
 
@@ -265,14 +310,22 @@ namespace packio
         // Function to deserialize a Serializable type
         template<typename... Args>
         requires (sizeof...(Args) > 0)
-        static auto deserialize(std::istream& stream, const std::string &minVersion="") {
+        static auto deserialize(std::istream& stream, const std::string &minVersion="",
+                                const DecodeLimits &limits={}) {
             std::array<char, 16> signature{};
             stream.read(signature.data(), sizeof(char) * 16);
 
             SerializableVersion version{};
             stream.read(reinterpret_cast<char*>(&version), sizeof(version));
 
-            return DeserializeHelper<U, MAJOR, MINOR, PATCH, Args...>::deserialize(stream, signature);
+            return DeserializeHelper<U, MAJOR, MINOR, PATCH, Args...>::deserialize(stream, signature, limits);
+        }
+
+        // Function to deserialize a Serializable type under the given decode limits
+        template<typename... Args>
+        requires (sizeof...(Args) > 0)
+        static auto deserialize(std::istream& stream, const DecodeLimits &limits) {
+            return deserialize<Args...>(stream, "", limits);
         }
     };
 
@@ -281,12 +334,13 @@ namespace packio
      *
      * @tparam T The type of the serializable object to deserialize.
      * @param stream The input stream to deserialize from.
+     * @param limits Size limits checked against the header before allocating.
      * @return An instance of type T deserialized from the input stream.
      */
     template<typename T>
-    inline T deserialize(std::istream &stream)
+    inline T deserialize(std::istream &stream, const DecodeLimits &limits={})
     {
-        return packio::Deserializer<T>::template deserialize<T>(stream);
+        return packio::Deserializer<T>::template deserialize<T>(stream, limits);
     }
 
 
@@ -0,0 +1,129 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+#include "testutils/serializableinstances.h"
+#include "testutils/recordutils.h"
+#include <random>
+#include <sstream>
+
+using namespace packio;
+using namespace packio::testutils;
+
+TEST_CASE("Round trip within decode limits", "[packio]")
+{
+    std::mt19937 rng(42);
+    const auto payload = randomPayload(rng, 1 << 16);
+    const DecodeLimits limits{.maxRecordSize = 1 << 20, .maxCompressionRatio = 64};
+
+    SECTION("With compression")
+    {
+        std::stringstream stream(serializeBlob(payload, true));
+        REQUIRE(deserialize<TestBlob>(stream, limits).getPayload() == payload);
+    }
+    SECTION("Without compression")
+    {
+        std::stringstream stream(serializeBlob(payload, false));
+        REQUIRE(deserialize<TestBlob>(stream, limits).getPayload() == payload);
+    }
+}
+
+TEST_CASE("Decode limits are enforced", "[packio]")
+{
+    SECTION("Record size with compression")
+    {
+        std::stringstream stream(serializeBlob(std::vector<char>(4096, 'a'), true));
+        REQUIRE_THROWS_WITH(deserialize<TestBlob>(stream, DecodeLimits{.maxRecordSize = 1024}),
+                            Catch::Matchers::ContainsSubstring("Uncompressed size exceeds the decode limit"));
+    }
+    SECTION("Record size without compression")
+    {
+        std::stringstream stream(serializeBlob(std::vector<char>(4096, 'a'), false));
+        REQUIRE_THROWS_WITH(deserialize<TestBlob>(stream, DecodeLimits{.maxRecordSize = 1024}),
+                            Catch::Matchers::ContainsSubstring("Uncompressed size exceeds the decode limit"));
+    }
+    SECTION("Compression ratio")
+    {
+        std::stringstream stream(serializeBlob(std::vector<char>(1 << 20, '\0'), true));
+        REQUIRE_THROWS_WITH(deserialize<TestBlob>(stream, DecodeLimits{.maxCompressionRatio = 16}),
+                            Catch::Matchers::ContainsSubstring("Compression ratio exceeds the decode limit"));
+    }
+    SECTION("Compression ratio just above the limit")
+    {
+        const std::string data = serializeBlob(std::vector<char>(1 << 20, '\0'), true);
+        const size_t uncompressedSize = readSize(data, UNCOMPRESSED_SIZE_OFFSET);
+        const size_t compressedSize = readSize(data, COMPRESSED_SIZE_OFFSET);
+        REQUIRE(uncompressedSize % compressedSize != 0);
+
+        std::stringstream stream(data);
+        REQUIRE_THROWS_WITH(deserialize<TestBlob>(stream,
+                                                  DecodeLimits{.maxCompressionRatio = uncompressedSize / compressedSize}),
+                            Catch::Matchers::ContainsSubstring("Compression ratio exceeds the decode limit"));
+        std::stringstream admittedStream(data);
+        REQUIRE_NOTHROW(deserialize<TestBlob>(admittedStream,
+                                              DecodeLimits{.maxCompressionRatio = uncompressedSize / compressedSize + 1}));
+    }
+}
+
+TEST_CASE("Decode limits apply to every type of a multi-type Deserializer", "[packio]")
+{
+    const DecodeLimits limits{.maxRecordSize = 1024};
+
+    SECTION("Record size with compression")
+    {
+        std::stringstream stream(serializeBlob(std::vector<char>(4096, 'a'), true));
+        REQUIRE_THROWS_WITH((Deserializer<TestBlobVariant>::deserialize<TestBlob, TestMock1>(stream, limits)),
+                            Catch::Matchers::ContainsSubstring("Uncompressed size exceeds the decode limit"));
+    }
+    SECTION("Record size without compression")
+    {
+        std::stringstream stream(serializeBlob(std::vector<char>(4096, 'a'), false));
+        REQUIRE_THROWS_WITH((Deserializer<TestBlobVariant>::deserialize<TestBlob, TestMock1>(stream, limits)),
+                            Catch::Matchers::ContainsSubstring("Uncompressed size exceeds the decode limit"));
+    }
+    SECTION("Compression flag")
+    {
+        std::stringstream stream{};
+        serialize(TestMock1{}, stream);
+        std::string corrupted = stream.str();
+        corrupted[UNCOMPRESSED_SIZE_OFFSET - 1] = 0x7F;
+        std::stringstream corruptedStream(corrupted);
+        REQUIRE_THROWS_WITH((Deserializer<TestMockVariant>::deserialize<TestMock1, TestMock2>(corruptedStream)),
+                            Catch::Matchers::ContainsSubstring("Invalid compression flag"));
+    }
+}
+
+TEST_CASE("Corrupted header sizes are rejected", "[packio]")
+{
+    const std::string data = serializeBlob(std::vector<char>(4096, 'a'), true);
+
+    SECTION("Uncompressed size")
+    {
+        std::string corrupted = data;
+        overwriteSize(corrupted, UNCOMPRESSED_SIZE_OFFSET, size_t{1} << 40);
+        std::stringstream stream(corrupted);
+        REQUIRE_THROWS_WITH(deserialize<TestBlob>(stream),
+                            Catch::Matchers::ContainsSubstring("Decompression size mismatch"));
+    }
+    SECTION("Compressed size")
+    {
+        std::string corrupted = data;
+        overwriteSize(corrupted, UNCOMPRESSED_SIZE_OFFSET, size_t{1} << 40);
+        overwriteSize(corrupted, COMPRESSED_SIZE_OFFSET, size_t{1} << 39);
+        std::stringstream stream(corrupted);
+        REQUIRE_THROWS_WITH(deserialize<TestBlob>(stream),
+                            Catch::Matchers::ContainsSubstring("Failed to read compressed data"));
+    }
+    SECTION("Uncompressed size with a frame lacking its content size")
+    {
+        std::stringstream stream(serializeBlobWithoutContentSize(std::vector<char>(16, 'a'), size_t{1} << 36));
+        REQUIRE_THROWS_WITH(deserialize<TestBlob>(stream),
+                            Catch::Matchers::ContainsSubstring("frame content size is unknown"));
+    }
+    SECTION("Compression flag")
+    {
+        std::string corrupted = data;
+        corrupted[UNCOMPRESSED_SIZE_OFFSET - 1] = 0x7F;
+        std::stringstream stream(corrupted);
+        REQUIRE_THROWS_WITH(deserialize<TestBlob>(stream),
+                            Catch::Matchers::ContainsSubstring("Invalid compression flag"));
+    }
+}
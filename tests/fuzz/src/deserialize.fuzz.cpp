@@ -0,0 +1,81 @@
+#include "testutils/serializableinstances.h"
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+using namespace packio;
+using namespace packio::testutils;
+
+// Tight limits so that a successful decode stays well below the fuzzer memory budget
+static constexpr DecodeLimits FUZZ_LIMITS{.maxRecordSize = 1 << 20, .maxCompressionRatio = 1024};
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size)
+{
+    const std::string input(reinterpret_cast<const char*>(data), size);
+
+    // Any std::exception is an expected rejection; crashes, leaks and budget overruns are the findings
+    try {
+        std::istringstream stream(input, std::ios::binary);
+        (void) Deserializer<TestMockVariant>::deserialize<TestMock1, TestMock2>(stream, FUZZ_LIMITS);
+    } catch (const std::exception&) {
+    }
+    try {
+        std::istringstream stream(input, std::ios::binary);
+        (void) deserialize<TestBlob>(stream, FUZZ_LIMITS);
+    } catch (const std::exception&) {
+    }
+    return 0;
+}
+
+#ifdef PACKIO_FUZZ_STANDALONE
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+// Standalone driver for toolchains without libFuzzer: replays every file given on the command line (directories
+// are walked recursively) and fails if a single input exceeds the time budget. Memory is not bounded here.
+int main(int argc, char** argv)
+{
+    static constexpr auto TIME_BUDGET = std::chrono::milliseconds(PACKIO_FUZZ_TIME_BUDGET_MS);
+
+    std::vector<std::filesystem::path> inputs;
+    for (int i = 1; i < argc; ++i) {
+        if (std::filesystem::is_directory(argv[i])) {
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(argv[i])) {
+                if (entry.is_regular_file()) {
+                    inputs.push_back(entry.path());
+                }
+            }
+        } else {
+            inputs.emplace_back(argv[i]);
+        }
+    }
+
+    if (inputs.empty()) {
+        std::cerr << "No input to replay\n";
+        return 1;
+    }
+
+    int status = 0;
+    for (const auto& path : inputs) {
+        std::ifstream file(path, std::ios::binary);
+        const std::vector<char> bytes{std::istreambuf_iterator<char>(file), {}};
+
+        const auto start = std::chrono::steady_clock::now();
+        LLVMFuzzerTestOneInput(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size());
+        const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start);
+
+        if (elapsed > TIME_BUDGET) {
+            std::cerr << path << ": " << elapsed.count() << " ms exceeds the time budget\n";
+            status = 1;
+        }
+    }
+    std::cout << "Executed " << inputs.size() << " inputs\n";
+    return status;
+}
+#endif
@@ -0,0 +1,139 @@
+#include <catch2/catch_test_macros.hpp>
+#include "testutils/serializableinstances.h"
+#include "testutils/recordutils.h"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <sstream>
+
+using namespace packio;
+using namespace packio::testutils;
+
+// Track the largest single allocation so tests can assert that header sizes are not trusted for allocations
+namespace {
+    std::atomic<size_t> largestAllocation{0};
+
+    void* trackedAllocation(std::size_t size, std::size_t alignment) {
+        size_t current = largestAllocation.load(std::memory_order_relaxed);
+        while (size > current && !largestAllocation.compare_exchange_weak(current, size, std::memory_order_relaxed)) {}
+
+        if (alignment <= alignof(std::max_align_t)) {
+            return std::malloc(size ? size : 1);
+        }
+        // aligned_alloc requires the size to be a multiple of the alignment
+        return std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+    }
+}
+
+void* operator new(std::size_t size) {
+    if (void* ptr = trackedAllocation(size, alignof(std::max_align_t))) {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    if (void* ptr = trackedAllocation(size, static_cast<std::size_t>(alignment))) {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return trackedAllocation(size, alignof(std::max_align_t));
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return trackedAllocation(size, static_cast<std::size_t>(alignment));
+}
+
+// Every other deallocation form forwards to this one
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { ::operator delete(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { ::operator delete(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { ::operator delete(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { ::operator delete(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { ::operator delete(ptr); }
+
+namespace {
+    // Budgets per decoded input: one read chunk plus a few copies of the input, and a generous wall-clock bound
+    constexpr size_t ALLOCATION_SLACK = size_t{2} << 20;
+    constexpr auto TIME_BUDGET = std::chrono::milliseconds(250);
+
+    // Decode the input, swallowing the expected errors, and return the largest single allocation made
+    size_t decodeWithinBudget(const std::string& data, const DecodeLimits& limits = {}) {
+        std::stringstream stream(data, std::ios::in | std::ios::binary);
+        largestAllocation = 0;
+        const auto start = std::chrono::steady_clock::now();
+        try {
+            (void) deserialize<TestBlob>(stream, limits);
+        } catch (const std::exception&) {
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        const size_t allocated = largestAllocation.load();
+
+        REQUIRE(elapsed < TIME_BUDGET);
+        REQUIRE(allocated <= ALLOCATION_SLACK + 4 * data.size());
+        return allocated;
+    }
+}
+
+TEST_CASE("Corrupted header sizes are rejected before allocation", "[packio][stress]")
+{
+    const std::string data = serializeBlob(std::vector<char>(4096, 'a'), true);
+
+    SECTION("Uncompressed size")
+    {
+        std::string corrupted = data;
+        overwriteSize(corrupted, UNCOMPRESSED_SIZE_OFFSET, size_t{1} << 40);
+        REQUIRE(decodeWithinBudget(corrupted) < ALLOCATION_SLACK);
+    }
+    SECTION("Compressed size")
+    {
+        std::string corrupted = data;
+        overwriteSize(corrupted, UNCOMPRESSED_SIZE_OFFSET, size_t{1} << 40);
+        overwriteSize(corrupted, COMPRESSED_SIZE_OFFSET, size_t{1} << 39);
+        REQUIRE(decodeWithinBudget(corrupted) < ALLOCATION_SLACK);
+    }
+    SECTION("Uncompressed size with a frame lacking its content size")
+    {
+        const std::string corrupted = serializeBlobWithoutContentSize(std::vector<char>(16, 'a'), size_t{1} << 36);
+        REQUIRE(decodeWithinBudget(corrupted) < ALLOCATION_SLACK);
+    }
+}
+
+TEST_CASE("Stress mutated streams within memory and time budgets", "[packio][stress]")
+{
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<size_t> payloadSize(0, 1 << 14);
+    std::uniform_int_distribution<int> mutationKind(0, 2);
+    std::uniform_int_distribution<int> byte(0, 255);
+    const DecodeLimits limits{.maxRecordSize = 1 << 20, .maxCompressionRatio = 1024};
+
+    for (int iteration = 0; iteration < 2000; ++iteration) {
+        std::string data = serializeBlob(randomPayload(rng, payloadSize(rng)), iteration % 2 == 0);
+        std::uniform_int_distribution<size_t> position(0, data.size() - 1);
+
+        switch (mutationKind(rng)) {
+            case 0:  // Flip a few random bytes anywhere in the stream
+                for (int i = 0; i < 4; ++i) {
+                    data[position(rng)] = static_cast<char>(byte(rng));
+                }
+                break;
+            case 1:  // Truncate the stream
+                data.resize(position(rng));
+                break;
+            default:  // Overwrite one of the header sizes with an arbitrary value
+                if (data.size() >= COMPRESSED_SIZE_OFFSET + sizeof(size_t)) {
+                    overwriteSize(data, rng() % 2 ? UNCOMPRESSED_SIZE_OFFSET : COMPRESSED_SIZE_OFFSET,
+                                  (static_cast<size_t>(rng()) << 32) | rng());
+                }
+                break;
+        }
+
+        decodeWithinBudget(data);
+        decodeWithinBudget(data, limits);
+    }
+}
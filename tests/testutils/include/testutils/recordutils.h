@@ -0,0 +1,75 @@
+#ifndef SERIALIZE_TESTUTILS_RECORDUTILS_H
+#define SERIALIZE_TESTUTILS_RECORDUTILS_H
+#include "testutils/serializableinstances.h"
+#include <zstd.h>
+#include <cstring>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace packio::testutils {
+    // Header layout: signature (16) + version (6) + compression flag (1) + uncompressed size + compressed size
+    constexpr size_t UNCOMPRESSED_SIZE_OFFSET = 16 + sizeof(SerializableVersion) + 1;
+    constexpr size_t COMPRESSED_SIZE_OFFSET = UNCOMPRESSED_SIZE_OFFSET + sizeof(size_t);
+
+    inline std::string serializeBlob(const std::vector<char>& payload, bool compressed) {
+        std::stringstream stream{};
+        if (compressed) {
+            serialize<TestBlob, true>(TestBlob{payload}, stream);
+        } else {
+            serialize<TestBlob, false>(TestBlob{payload}, stream);
+        }
+        return stream.str();
+    }
+
+    inline void overwriteSize(std::string& data, size_t offset, size_t value) {
+        std::memcpy(data.data() + offset, &value, sizeof(value));
+    }
+
+    inline size_t readSize(const std::string& data, size_t offset) {
+        size_t value;
+        std::memcpy(&value, data.data() + offset, sizeof(value));
+        return value;
+    }
+
+    inline std::vector<char> randomPayload(std::mt19937& rng, size_t size) {
+        std::uniform_int_distribution<int> byte(0, 15);  // Small alphabet so the payload remains compressible
+        std::vector<char> payload(size);
+        for (auto& c : payload) {
+            c = static_cast<char>('a' + byte(rng));
+        }
+        return payload;
+    }
+
+    // Build a compressed TestBlob record whose zstd frame omits the content size, with a valid checksum
+    inline std::string serializeBlobWithoutContentSize(const std::vector<char>& payload,
+                                                       size_t headerUncompressedSize) {
+        ZSTD_CCtx* cctx = ZSTD_createCCtx();
+        ZSTD_CCtx_setParameter(cctx, ZSTD_c_contentSizeFlag, 0);
+        std::vector<char> compressed(ZSTD_compressBound(payload.size()));
+        const size_t compressedSize = ZSTD_compress2(cctx, compressed.data(), compressed.size(),
+                                                     payload.data(), payload.size());
+        ZSTD_freeCCtx(cctx);
+        if (ZSTD_isError(compressedSize)) {
+            throw std::runtime_error(std::string("Zstd compression failed: ") + ZSTD_getErrorName(compressedSize));
+        }
+
+        std::stringstream stream{};
+        const auto signature = serializeSignature<TestBlob>();
+        const SerializableVersion version{PACKIO_VER_MAJOR, PACKIO_VER_MINOR, PACKIO_VER_PATCH};
+        const uint8_t compressionFlag = 1;
+        const uint64_t checksum = computeChecksum(compressed.data(), compressedSize);
+        writeAll(stream, signature.data(), signature.size(), "Failed to write signature");
+        writeAll(stream, &version, sizeof(version), "Failed to write version");
+        writeAll(stream, &compressionFlag, sizeof(compressionFlag), "Failed to write compression flag");
+        writeAll(stream, &headerUncompressedSize, sizeof(headerUncompressedSize), "Failed to write uncompressed size");
+        writeAll(stream, &compressedSize, sizeof(compressedSize), "Failed to write compressed size");
+        writeAll(stream, &checksum, sizeof(checksum), "Failed to write checksum");
+        writeAll(stream, compressed.data(), static_cast<std::streamsize>(compressedSize),
+                 "Failed to write compressed data");
+        return stream.str();
+    }
+} //namespace packio::testutils
+#endif //SERIALIZE_TESTUTILS_RECORDUTILS_H
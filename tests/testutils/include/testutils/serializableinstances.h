@@ -3,6 +3,9 @@
 #include "packio/core/serializable.h"
 #include "packio/core/version.h"
 #include <variant>
+#include <vector>
+#include <iterator>
+#include <utility>
 
 namespace packio::testutils {
     class TestMock1 {
@@ -20,6 +23,17 @@ namespace packio::testutils {
     };
 
     using TestMockVariant = std::variant<TestMock1, TestMock2>;
+
+    class TestBlob {
+    public:
+        TestBlob() = default;
+        explicit TestBlob(std::vector<char> payload) : payload_(std::move(payload)) {}
+        [[nodiscard]] const auto& getPayload() const {return payload_;}
+    private:
+        std::vector<char> payload_;
+    };
+
+    using TestBlobVariant = std::variant<TestBlob, TestMock1>;
 }
 
 namespace packio
@@ -34,20 +48,20 @@ namespace packio
     }
 
     template<>
-    void serializeBody(const testutils::TestMock1 &serializable, std::ostream &stream)
+    inline void serializeBody(const testutils::TestMock1 &serializable, std::ostream &stream)
     {
         (void) serializable, stream;
     }
 
     template<>
-    testutils::TestMockVariant deserializeBody<testutils::TestMockVariant, testutils::TestMock1>(std::istream &stream)
+    inline testutils::TestMockVariant deserializeBody<testutils::TestMockVariant, testutils::TestMock1>(std::istream &stream)
     {
         return testutils::TestMock1{};
     }
 
     // Or
     template<>
-    testutils::TestMock1 deserializeBody<testutils::TestMock1>(std::istream &stream)
+    inline testutils::TestMock1 deserializeBody<testutils::TestMock1>(std::istream &stream)
     {
         return testutils::TestMock1{};
     }
@@ -62,22 +76,57 @@ namespace packio
     }
 
     template<>
-    void serializeBody(const testutils::TestMock2 &serializable, std::ostream &stream)
+    inline void serializeBody(const testutils::TestMock2 &serializable, std::ostream &stream)
     {
         (void) serializable, stream;
     }
 
     template<>
-    testutils::TestMockVariant deserializeBody<testutils::TestMockVariant, testutils::TestMock2>(std::istream &stream)
+    inline testutils::TestMockVariant deserializeBody<testutils::TestMockVariant, testutils::TestMock2>(std::istream &stream)
     {
         return testutils::TestMock2{};
     }
 
     // Or
     template<>
-    testutils::TestMock2 deserializeBody<testutils::TestMock2>(std::istream &stream)
+    inline testutils::TestMock2 deserializeBody<testutils::TestMock2>(std::istream &stream)
     {
         return testutils::TestMock2{};
     }
+
+    // ######################################################################################
+    // TestBlob
+    // ######################################################################################
+    template<>
+    constexpr std::array<char, 16> serializeSignature<testutils::TestBlob>()
+    {
+        return {'T', 'e', 's', 't', 'B', 'l', 'o', 'b', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' '};
+    }
+
+    template<>
+    inline void serializeBody(const testutils::TestBlob &serializable, std::ostream &stream)
+    {
+        const auto& payload = serializable.getPayload();
+        stream.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+    }
+
+    template<>
+    inline testutils::TestBlobVariant deserializeBody<testutils::TestBlobVariant, testutils::TestBlob>(std::istream &stream)
+    {
+        return testutils::TestBlob{std::vector<char>(std::istreambuf_iterator<char>(stream), {})};
+    }
+
+    template<>
+    inline testutils::TestBlobVariant deserializeBody<testutils::TestBlobVariant, testutils::TestMock1>(std::istream &stream)
+    {
+        return testutils::TestMock1{};
+    }
+
+    // Or
+    template<>
+    inline testutils::TestBlob deserializeBody<testutils::TestBlob>(std::istream &stream)
+    {
+        return testutils::TestBlob{std::vector<char>(std::istreambuf_iterator<char>(stream), {})};
+    }
 } //namespace serialize::testutils
 #endif //SERIALIZE_TESTUTILS_SERIALIZABLEINSTANCES_H